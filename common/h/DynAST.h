@@ -70,6 +70,7 @@ class ASTVisitor;
  class ConstantAST;
  class VariableAST;
  class RoseAST;
+ class ASTFactory;
  };
  // Stack analysis...
  class StackAST;
@@ -103,6 +104,7 @@ class name : public AST {						\
   }									\
   const type &val() const { return t_; }				\
  private:								\
+ friend class Dyninst::DataflowAPI::ASTFactory;				\
  name(type t) : t_(t) {};						\
  virtual bool isStrictEqual(const AST &rhs) const {			\
    const name &other(dynamic_cast<const name&>(rhs));			\
@@ -139,6 +141,7 @@ class name : public AST {						\
   const type &val() const { return t_; }				\
   void setChild(int i, AST::Ptr a) { kids_[i] = a; };			\
  private:								\
+ friend class Dyninst::DataflowAPI::ASTFactory;				\
  name(type t, AST::Ptr a) : t_(t) { kids_.push_back(a); };		\
  name(type t, AST::Ptr a, AST::Ptr b) : t_(t) {				\
     kids_.push_back(a);							\
@@ -192,6 +195,8 @@ class COMMON_EXPORT AST : public boost::enable_shared_from_this<AST> {
   virtual ~AST() {};
   
   bool operator==(const AST &rhs) const {
+    // Hash-consed nodes (see DataflowAPI::ASTFactory) compare by identity
+    if (this == &rhs) return true;
     // make sure rhs and this have the same type
     return((typeid(*this) == typeid(rhs)) && isStrictEqual(rhs));
   }
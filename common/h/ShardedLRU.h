@@ -0,0 +1,221 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#if !defined(_SHARDED_LRU_H_)
+#define _SHARDED_LRU_H_
+
+#include <list>
+#include <algorithm>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/atomic.hpp>
+#include "dyntypes.h"
+
+namespace Dyninst {
+
+// A bounded, thread-safe map that evicts its least recently used entries.
+// It is split into shards, each with its own lock and an equal share of
+// the budget.  Entry sizes are estimates supplied by the caller.
+//
+// ShardHash picks a key's shard; keys that are invalidated together
+// (e.g. everything cached for one block) should hash alike, so that
+// erase_if can be limited to one shard.
+template <typename Key, typename Value, typename KeyHash, typename ShardHash = KeyHash>
+class ShardedLRU {
+ public:
+   struct Stats {
+      unsigned long hits;
+      unsigned long misses;
+      unsigned long evictions;
+      unsigned long entries;
+      size_t bytes;
+   };
+
+   ShardedLRU(size_t budget) : budget_(budget) {}
+
+   // If k is present, marks it most recently used and calls f(value)
+   // with its shard locked
+   template <typename F>
+   bool find(const Key &k, F f) {
+      Shard &s = shardFor(k);
+      boost::lock_guard<boost::mutex> g(s.lock);
+      typename index_map::iterator it = s.index.find(k);
+      if (it == s.index.end()) {
+         s.misses++;
+         return false;
+      }
+      s.lru.splice(s.lru.begin(), s.lru, it->second);
+      s.hits++;
+      f(const_cast<const Value &>(it->second->value));
+      return true;
+   }
+
+   // Whether an entry of this size can be cached at all
+   bool fits(size_t bytes) const {
+      return bytes <= shardBudget();
+   }
+
+   // Takes value (by swapping it out) unless k is already present or the
+   // entry doesn't fit; the first entry for a key wins
+   void insert(const Key &k, Value &value, size_t bytes) {
+      size_t limit = shardBudget();
+      if (bytes > limit) return;
+      Shard &s = shardFor(k);
+      boost::lock_guard<boost::mutex> g(s.lock);
+      if (s.index.find(k) != s.index.end()) return;
+      s.lru.push_front(Entry());
+      Entry &e = s.lru.front();
+      e.key = k;
+      std::swap(e.value, value);
+      e.bytes = bytes;
+      s.index[k] = s.lru.begin();
+      s.bytes += bytes;
+      evict(s, limit);
+   }
+
+   void erase(const Key &k) {
+      Shard &s = shardFor(k);
+      boost::lock_guard<boost::mutex> g(s.lock);
+      typename index_map::iterator it = s.index.find(k);
+      if (it != s.index.end())
+         erase(s, it->second);
+   }
+
+   // Erases the entries for which p(key) holds, looking only in the
+   // shard of in_shard_of
+   template <typename P>
+   void erase_if(const Key &in_shard_of, P p) {
+      Shard &s = shardFor(in_shard_of);
+      boost::lock_guard<boost::mutex> g(s.lock);
+      erase_if(s, p);
+   }
+
+   // Erases the entries for which p(key) holds, in every shard
+   template <typename P>
+   void erase_if(P p) {
+      for (unsigned i = 0; i < num_shards; ++i) {
+         boost::lock_guard<boost::mutex> g(shards_[i].lock);
+         erase_if(shards_[i], p);
+      }
+   }
+
+   void clear() {
+      for (unsigned i = 0; i < num_shards; ++i) {
+         boost::lock_guard<boost::mutex> g(shards_[i].lock);
+         shards_[i].lru.clear();
+         shards_[i].index.clear();
+         shards_[i].bytes = 0;
+      }
+   }
+
+   // A budget of 0 disables caching
+   void setBudget(size_t bytes) {
+      budget_ = bytes;
+      for (unsigned i = 0; i < num_shards; ++i) {
+         boost::lock_guard<boost::mutex> g(shards_[i].lock);
+         evict(shards_[i], shardBudget());
+      }
+   }
+
+   size_t budget() const {
+      return budget_;
+   }
+
+   Stats stats() const {
+      Stats st = Stats();
+      for (unsigned i = 0; i < num_shards; ++i) {
+         boost::lock_guard<boost::mutex> g(shards_[i].lock);
+         st.hits += shards_[i].hits;
+         st.misses += shards_[i].misses;
+         st.evictions += shards_[i].evictions;
+         st.entries += shards_[i].lru.size();
+         st.bytes += shards_[i].bytes;
+      }
+      return st;
+   }
+
+ private:
+   struct Entry {
+      Key key;
+      Value value;
+      size_t bytes;
+   };
+   typedef std::list<Entry> lru_list;
+   typedef dyn_hash_map<Key, typename lru_list::iterator, KeyHash> index_map;
+
+   struct Shard {
+      mutable boost::mutex lock;
+      lru_list lru;                 // most recently used first
+      index_map index;
+      size_t bytes;
+      unsigned long hits;
+      unsigned long misses;
+      unsigned long evictions;
+      Shard() : bytes(0), hits(0), misses(0), evictions(0) {}
+   };
+
+   static const unsigned num_shards = 16;
+
+   size_t shardBudget() const {
+      return budget_ / num_shards;
+   }
+
+   Shard &shardFor(const Key &k) {
+      return shards_[ShardHash()(k) % num_shards];
+   }
+
+   void erase(Shard &s, typename lru_list::iterator it) {
+      s.bytes -= it->bytes;
+      s.index.erase(it->key);
+      s.lru.erase(it);
+   }
+
+   template <typename P>
+   void erase_if(Shard &s, P p) {
+      for (typename lru_list::iterator it = s.lru.begin(); it != s.lru.end(); ) {
+         typename lru_list::iterator cur = it++;
+         if (p(cur->key)) erase(s, cur);
+      }
+   }
+
+   void evict(Shard &s, size_t limit) {
+      while (s.bytes > limit && !s.lru.empty()) {
+         erase(s, --s.lru.end());
+         s.evictions++;
+      }
+   }
+
+   Shard shards_[num_shards];
+   boost::atomic<size_t> budget_;
+};
+
+}
+
+#endif
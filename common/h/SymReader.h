@@ -34,6 +34,7 @@
 #include "util.h"
 #include "dyn_regs.h"
 #include <string>
+#include <vector>
 
 namespace Dyninst
 {
@@ -88,6 +89,14 @@ class COMMON_EXPORT SymReader
    virtual ~SymReader() {}
  public:
    virtual Symbol_t getSymbolByName(std::string symname) = 0;
+   // syms[i] is the result of getSymbolByName(names[i])
+   virtual void getSymbolsByName(const std::vector<std::string> &names,
+                                 std::vector<Symbol_t> &syms)
+   {
+      syms.clear();
+      for (unsigned i = 0; i < names.size(); i++)
+         syms.push_back(getSymbolByName(names[i]));
+   }
    virtual Symbol_t getContainingSymbol(Dyninst::Offset offset) = 0;
    virtual std::string getInterpreterName() = 0;
    virtual unsigned getAddressWidth() = 0;
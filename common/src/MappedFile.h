@@ -57,6 +57,32 @@ class MappedFile {
       COMMON_EXPORT void setSharing(bool s);
       COMMON_EXPORT bool canBeShared();
 
+      // How mapped files are read.  io_hints advises each section by how
+      // it is parsed (read ahead for tables walked front to back, random
+      // access for debug info), io_populate reads whole files into the
+      // page cache when they are mapped, and io_release drops a section's pages once the
+      // phase that parses it is done.  The default is io_hints.
+      enum io_policy_t {
+         io_hints = 0x1,
+         io_populate = 0x2,
+         io_release = 0x4
+      };
+      COMMON_EXPORT static void setIOPolicy(unsigned policy);
+      COMMON_EXPORT static unsigned getIOPolicy();
+
+      // Access-pattern advice for [addr, addr+len) of a mapping; the part
+      // outside the mapping is ignored.  Returns false if nothing was
+      // advised.  access_dontneed only covers pages wholly in the range.
+      enum access_t {
+         access_sequential,
+         access_random,
+         access_willneed,
+         access_dontneed
+      };
+      COMMON_EXPORT bool advise(const void *addr, unsigned long len, access_t how);
+      COMMON_EXPORT static bool advise(void *map_base, unsigned long map_size,
+                                       const void *addr, unsigned long len, access_t how);
+
    private:
 
       MappedFile(std::string fullpath_, bool &ok);
@@ -974,6 +974,22 @@ ia32_decode_opcode(unsigned int capa, const unsigned char *addr, ia32_instructio
 COMMON_EXPORT ia32_instruction &
 ia32_decode(unsigned int capabilities, const unsigned char *addr, ia32_instruction &, bool mode_64);
 
+/**
+ * Find the instruction boundaries of a linear sweep over [buf, buf + len).
+ * The size of each instruction is appended to lengths in order; a byte
+ * that does not start a valid instruction is reported as size 0 and the
+ * sweep resumes at the next byte. An instruction that would run past the
+ * end of the buffer is not reported. Returns the number of bytes covered.
+ *
+ * Runs of padding and a table of fixed-length one-byte opcodes are
+ * handled without going through the full decoder; everything else is
+ * sized by ia32_decode, so the result matches decoding the instructions
+ * one at a time.
+ */
+COMMON_EXPORT size_t
+ia32_decode_lengths(const unsigned char *buf, size_t len, bool mode_64,
+                    std::vector<unsigned char> &lengths);
+
 
 enum dynamic_call_address_mode {
   REGISTER_DIRECT, REGISTER_INDIRECT,
@@ -0,0 +1,105 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#if !defined(ASTFactory_h)
+#define ASTFactory_h
+
+#include <vector>
+
+#include "SymEval.h"
+#include "util.h"
+
+namespace Dyninst {
+namespace DataflowAPI {
+
+class ASTArena;
+
+// A hash-consing factory for SymEval ASTs.
+//
+// Every node made by a factory is unique up to structure: asking for a
+// node that already exists returns the existing one, so two factory
+// nodes are equal exactly when their pointers are. Nodes live in an
+// arena owned by the factory and are shared, which means they must be
+// treated as immutable; never call setChild on them. A node may outlive
+// its factory; the arena is released when the last node goes away.
+//
+// A factory is meant to be private to one analysis and is not
+// thread-safe.
+class ASTFactory {
+ public:
+  DATAFLOW_EXPORT ASTFactory();
+  DATAFLOW_EXPORT ~ASTFactory();
+
+  DATAFLOW_EXPORT BottomAST::Ptr bottom(bool b);
+  DATAFLOW_EXPORT ConstantAST::Ptr constant(const Constant &c);
+  DATAFLOW_EXPORT VariableAST::Ptr variable(const Variable &v);
+  // Children must already belong to this factory
+  DATAFLOW_EXPORT RoseAST::Ptr rose(const ROSEOperation &op, const AST::Children &kids);
+  DATAFLOW_EXPORT RoseAST::Ptr rose(const ROSEOperation &op, AST::Ptr a);
+  DATAFLOW_EXPORT RoseAST::Ptr rose(const ROSEOperation &op, AST::Ptr a, AST::Ptr b);
+  DATAFLOW_EXPORT RoseAST::Ptr rose(const ROSEOperation &op, AST::Ptr a, AST::Ptr b, AST::Ptr c);
+
+  // The canonical copy of an arbitrary SymEval tree. Returns the
+  // argument itself if it already belongs to this factory, and NULL for
+  // node types the factory does not know.
+  DATAFLOW_EXPORT AST::Ptr intern(const AST::Ptr &ast);
+  DATAFLOW_EXPORT bool owns(const AST::Ptr &ast) const;
+
+  // Memoized rewrites. Since nodes are unique, the result of a pure
+  // rewrite of a node can be recorded against its pointer; context
+  // distinguishes rewrites (and their parameters) from each other.
+  DATAFLOW_EXPORT AST::Ptr lookupRewrite(const AST::Ptr &ast, uint64_t context) const;
+  DATAFLOW_EXPORT void recordRewrite(const AST::Ptr &ast, uint64_t context, const AST::Ptr &result);
+
+  DATAFLOW_EXPORT size_t numNodes() const { return nodes_; }
+  DATAFLOW_EXPORT size_t numHits() const { return hits_; }
+  DATAFLOW_EXPORT size_t arenaBytes() const;
+
+ private:
+  ASTFactory(const ASTFactory &);
+  ASTFactory &operator=(const ASTFactory &);
+
+  template <typename T> typename T::Ptr place(T *node, size_t hash);
+
+  boost::shared_ptr<ASTArena> arena_;
+  dyn_hash_map<size_t, std::vector<AST::Ptr> > table_;
+  dyn_hash_map<const AST *, size_t> owned_;
+  struct RewriteHash {
+    size_t operator()(const std::pair<const AST *, uint64_t> &k) const;
+  };
+  dyn_hash_map<std::pair<const AST *, uint64_t>, AST::Ptr, RewriteHash> rewrites_;
+  size_t nodes_;
+  size_t hits_;
+};
+
+}
+}
+
+#endif
@@ -154,6 +154,13 @@ class Absloc {
     return !(*this == rhs);
   }
 
+  // Interned ids. Every distinct Absloc is given a small integer id
+  // that is stable for the life of the process. Register ids are dense
+  // from zero; all other ids have NonRegisterID set.
+  static const unsigned NonRegisterID = 0x80000000u;
+  DATAFLOW_EXPORT unsigned id() const;
+  DATAFLOW_EXPORT static Absloc fromID(unsigned id);
+
   DATAFLOW_EXPORT static char typeToChar(const Type t) {
     switch(t) {
     case Register:
@@ -251,6 +258,12 @@ class AbsRegion {
   DATAFLOW_EXPORT AST::Ptr generator() const { return generator_; }
 
   DATAFLOW_EXPORT bool isImprecise() const { return type_ != Absloc::Unknown; }
+
+  // Interned id; regions that compare equal share one, and a precise
+  // region has the id of its absloc. Generator and size are not part
+  // of the identity.
+  DATAFLOW_EXPORT unsigned id() const;
+  DATAFLOW_EXPORT static AbsRegion fromID(unsigned id);
   DATAFLOW_EXPORT void flipPredicateCondition() { absloc_.flipPredicateCondition(); }
   friend std::ostream &operator<<(std::ostream &os, const AbsRegion &a) {
     os << a.format();
@@ -274,6 +287,44 @@ class AbsRegion {
 };
 
 
+// A set of interned Absloc/AbsRegion ids. Registers are kept in a
+// bitset indexed by id and everything else in a sorted vector, so
+// register-heavy sets cost a few words and membership never compares
+// Abslocs field by field.
+class AbslocSet {
+ public:
+  DATAFLOW_EXPORT AbslocSet() : size_(0) {}
+
+  // Each returns true if the set changed
+  DATAFLOW_EXPORT bool insert(unsigned id);
+  DATAFLOW_EXPORT bool insert(const Absloc &a) { return insert(a.id()); }
+  DATAFLOW_EXPORT bool insert(const AbsRegion &r) { return insert(r.id()); }
+  DATAFLOW_EXPORT bool insert(const AbslocSet &rhs);
+  DATAFLOW_EXPORT bool erase(unsigned id);
+  DATAFLOW_EXPORT bool erase(const Absloc &a) { return erase(a.id()); }
+  DATAFLOW_EXPORT bool erase(const AbsRegion &r) { return erase(r.id()); }
+
+  DATAFLOW_EXPORT bool contains(unsigned id) const;
+  DATAFLOW_EXPORT bool contains(const Absloc &a) const { return contains(a.id()); }
+  DATAFLOW_EXPORT bool contains(const AbsRegion &r) const { return contains(r.id()); }
+  DATAFLOW_EXPORT bool intersects(const AbslocSet &rhs) const;
+
+  DATAFLOW_EXPORT size_t size() const { return size_; }
+  DATAFLOW_EXPORT bool empty() const { return size_ == 0; }
+  DATAFLOW_EXPORT void clear();
+
+  // Members in increasing id order
+  DATAFLOW_EXPORT void ids(std::vector<unsigned> &out) const;
+
+  DATAFLOW_EXPORT bool operator==(const AbslocSet &rhs) const;
+  DATAFLOW_EXPORT bool operator!=(const AbslocSet &rhs) const { return !(*this == rhs); }
+
+ private:
+  std::vector<uint64_t> regs_;
+  std::vector<unsigned> others_;
+  size_t size_;
+};
+
 class Assignment {
  public:
   typedef boost::shared_ptr<Assignment> Ptr;
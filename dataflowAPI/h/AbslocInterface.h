@@ -126,7 +126,7 @@ class AbsRegionConverter {
 
 class AssignmentConverter {
  public:  
- DATAFLOW_EXPORT AssignmentConverter(bool cache, bool stack) : cacheEnabled_(cache), aConverter(false, stack) {};
+ DATAFLOW_EXPORT AssignmentConverter(bool cache, bool stack) : cacheEnabled_(cache), stackAnalysisEnabled_(stack), aConverter(false, stack) {};
 
   DATAFLOW_EXPORT void convert(const InstructionAPI::Instruction &insn,
                                const Address &addr,
@@ -155,8 +155,12 @@ class AssignmentConverter {
   typedef std::map<Address, AssignmentVec> AddrCache;
   typedef std::map<ParseAPI::Function *, AddrCache> FuncCache;
 
+  // Results this converter has handed out, so repeated conversions
+  // return the same Assignments. Misses go to the CodeObject's shared
+  // AssignmentCache before converting.
   FuncCache cache_;
   bool cacheEnabled_;
+  bool stackAnalysisEnabled_;
 
   AbsRegionConverter aConverter;
 };
@@ -0,0 +1,120 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#if !defined(ASSIGNMENT_CACHE_H)
+#define ASSIGNMENT_CACHE_H
+
+#include <vector>
+#include "ShardedLRU.h"
+#include "Absloc.h"
+#include "util.h"
+
+namespace Dyninst {
+
+namespace ParseAPI {
+   class Function;
+   class Block;
+}
+
+// A bounded, thread-safe cache of instruction to assignment conversions,
+// shared by every AssignmentConverter working on one CodeObject
+// (CodeObject::assignmentCache()).
+//
+// Assignments are not immutable (symbolic evaluation sets the generator
+// of memory outputs), so the cache never hands out the objects it
+// holds: insert() stores copies and lookup() returns fresh copies.
+// Each converter keeps its own pointers stable by caching the copies it
+// receives, which is what the slicer's node identity relies on.
+class DATAFLOW_EXPORT AssignmentCache {
+ public:
+   typedef std::vector<Assignment::Ptr> AssignmentVec;
+
+   struct Stats {
+      unsigned long hits;
+      unsigned long misses;
+      unsigned long evictions;
+      unsigned long entries;
+      size_t bytes;
+   };
+
+   static const size_t default_budget = 32 * 1024 * 1024;
+
+   AssignmentCache(size_t budget = default_budget);
+   ~AssignmentCache();
+
+   // stack distinguishes converters with and without stack analysis,
+   // which produce different assignments for the same instruction
+   bool lookup(ParseAPI::Function *func, ParseAPI::Block *block,
+               Address addr, bool stack, AssignmentVec &assignments);
+   void insert(ParseAPI::Function *func, ParseAPI::Block *block,
+               Address addr, bool stack, const AssignmentVec &assignments);
+
+   void invalidate(ParseAPI::Block *block);
+   void invalidate(ParseAPI::Function *func);
+   void clear();
+
+   // A budget of 0 disables caching
+   void setBudget(size_t bytes);
+   size_t budget() const;
+   Stats stats() const;
+
+ private:
+   struct Key {
+      ParseAPI::Function *func;
+      ParseAPI::Block *block;
+      Address addr;
+      bool stack;
+      bool operator==(const Key &o) const {
+         return func == o.func && block == o.block && addr == o.addr && stack == o.stack;
+      }
+   };
+   struct KeyHash {
+      size_t operator()(const Key &k) const {
+         return std::hash<Address>()(k.addr) ^
+                (std::hash<void *>()(k.func) << 1) ^
+                (std::hash<void *>()(k.block) << 2) ^ k.stack;
+      }
+   };
+   // All entries of a block share a shard, so invalidating a block
+   // touches one lock
+   struct BlockHash {
+      size_t operator()(const Key &k) const {
+         return std::hash<void *>()(k.block);
+      }
+   };
+
+   static void copy(const AssignmentVec &from, AssignmentVec &to);
+   static size_t footprint(const AssignmentVec &assignments);
+
+   ShardedLRU<Key, AssignmentVec, KeyHash, BlockHash> lru_;
+};
+
+}
+
+#endif
@@ -0,0 +1,116 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+// A per-function def-use graph that answers many backward slice queries
+// without re-deriving assignments or re-walking the CFG for each one.
+
+#if !defined(_DEF_USE_GRAPH_H_)
+#define _DEF_USE_GRAPH_H_
+
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+#include "dyntypes.h"
+#include "util.h"
+#include "slicing.h"
+
+namespace Dyninst {
+
+namespace ParseAPI {
+  class CompactCFG;
+}
+
+// The graph is built once per function: every instruction is converted
+// to Assignments and numbered in block order over the function's
+// CompactCFG.  Use-def edges are computed on demand, the first time an
+// (assignment, input) pair is asked about, and memoized, so queries that
+// overlap share all of their work.
+//
+// Definitions are matched with the same rules as the Slicer: a
+// definition reaches a use if either region contains the other, and a
+// precise (non-region) definition kills the search along that path.
+// Slicing is intraprocedural; use the Slicer for interprocedural or
+// predicate-driven searches that modify the slice frame.
+class DefUseGraph {
+ public:
+  typedef boost::shared_ptr<DefUseGraph> Ptr;
+
+  DATAFLOW_EXPORT static Ptr create(ParseAPI::Function *func,
+                                    AssignmentConverter *ac = NULL);
+
+  DATAFLOW_EXPORT ParseAPI::Function *func() const { return func_; }
+  DATAFLOW_EXPORT int numAssignments() const { return (int) assigns_.size(); }
+  DATAFLOW_EXPORT Assignment::Ptr assignment(int id) const { return assigns_[id]; }
+  DATAFLOW_EXPORT ParseAPI::Block *block(int id) const;
+
+  // Our id for an assignment at the same address with the same output,
+  // or -1
+  DATAFLOW_EXPORT int find(Assignment::Ptr a) const;
+
+  // Definitions that may reach input `input' of assignment id
+  DATAFLOW_EXPORT const std::vector<int> &reachingDefs(int id, unsigned input);
+
+  // Definitions of reg that may reach the instruction at addr in block
+  DATAFLOW_EXPORT void reachingDefs(ParseAPI::Block *block, Address addr,
+                                    const AbsRegion &reg, std::vector<int> &defs);
+
+  // A backward slice from start, in the same form Slicer::backwardSlice
+  // returns.  Only endAtPoint and addPredecessor of the predicates are
+  // consulted.
+  DATAFLOW_EXPORT GraphPtr backwardSlice(Assignment::Ptr start,
+                                         Slicer::Predicates &p);
+  DATAFLOW_EXPORT GraphPtr backwardSlice(Assignment::Ptr start);
+
+ private:
+  DefUseGraph(ParseAPI::Function *f) : func_(f) {}
+  void build(AssignmentConverter &ac);
+  bool kills(const AbsRegion &reg, const Assignment::Ptr &a) const;
+  // Walk backwards from position pos (an index into assigns_, exclusive)
+  // in compact block b
+  void search(int b, int pos, const AbsRegion &reg, std::vector<int> &defs) const;
+
+  ParseAPI::Function *func_;
+  boost::shared_ptr<const ParseAPI::CompactCFG> cfg_;
+
+  std::vector<Assignment::Ptr> assigns_;
+  std::vector<int> assign_block_;    // compact block id
+  std::vector<int> insn_first_;      // first assignment of the same instruction
+  std::vector<int> block_begin_;     // assignments of block b: [block_begin_[b], block_begin_[b+1])
+  dyn_hash_map<Address, std::vector<int> > by_addr_;
+
+  // Memoized use-def edges, one slot per (assignment, input)
+  std::vector<int> input_begin_;
+  std::vector<std::vector<int> > memo_;
+  std::vector<char> memo_valid_;
+  boost::mutex memo_lock_;
+};
+
+}
+
+#endif
@@ -0,0 +1,124 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#if !defined(FUNCTION_SUMMARY_H)
+#define FUNCTION_SUMMARY_H
+
+#include <map>
+#include <set>
+#include <string>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+#include "dyntypes.h"
+#include "dyn_regs.h"
+#include "util.h"
+
+namespace Dyninst {
+
+namespace ParseAPI {
+   class CodeObject;
+}
+
+// ABI-level effects of one function, as seen by its callers.
+struct DATAFLOW_EXPORT FunctionSummary {
+   std::string name;
+   Address entry;           // offset of the entry in its object
+
+   // Liveness: registers that may be read before being written, and
+   // registers that may be written, anywhere below the entry.  defined
+   // includes callee-saved registers that are saved and restored, so it
+   // is not a kill set by itself
+   bool hasLiveness;
+   std::set<MachRegister> used;
+   std::set<MachRegister> defined;
+
+   // Stack analysis: bytes the function pops off its caller's stack
+   bool hasStackClean;
+   long stackClean;
+
+   bool noReturn;
+
+   FunctionSummary() : entry(0), hasLiveness(false), hasStackClean(false),
+                       stackClean(0), noReturn(false) {}
+};
+
+// A set of FunctionSummary records for one binary, identified by its
+// build-id so that a store saved next to a binary is only reused for
+// that exact build.
+//
+// Stores are attached to the CodeObjects they describe; LivenessAnalyzer,
+// StackAnalysis and the parser consult the attached store before
+// analyzing a callee and record what they compute into it.  Calls that go
+// through the linkage table (PLT) are resolved by name against every
+// attached store, which is how summaries for shared libraries are used
+// by their callers.
+class DATAFLOW_EXPORT SummaryStore {
+ public:
+   typedef boost::shared_ptr<SummaryStore> Ptr;
+
+   SummaryStore(const std::string &buildId, Architecture arch);
+
+   const std::string &buildId() const { return buildId_; }
+   Architecture arch() const { return arch_; }
+
+   bool lookup(Address entry, FunctionSummary &s) const;
+   bool lookup(const std::string &name, FunctionSummary &s) const;
+   // Merge s into the store; only the parts s has are overwritten
+   void update(const FunctionSummary &s);
+   size_t size() const;
+   bool dirty() const { return dirty_; }
+
+   // Text serialization. load() fails if the file was written for a
+   // different build-id or architecture.
+   bool save(const std::string &path);
+   bool load(const std::string &path);
+   // Conventional location: next to the binary
+   static std::string defaultPath(const std::string &binaryPath);
+
+   // Attach a store to the CodeObject it describes; a NULL store detaches
+   static void attach(ParseAPI::CodeObject *co, Ptr store);
+   static Ptr get(const ParseAPI::CodeObject *co);
+   // Look a function up by name in every attached store
+   static bool lookupExport(const std::string &name, FunctionSummary &s);
+
+ private:
+   std::string buildId_;
+   Architecture arch_;
+   bool dirty_;
+   mutable boost::mutex lock_;
+   std::map<Address, FunctionSummary> byEntry_;
+   std::map<std::string, Address> byName_;
+
+   static boost::mutex registry_lock_;
+   static std::map<const ParseAPI::CodeObject *, Ptr> registry_;
+};
+
+}
+
+#endif
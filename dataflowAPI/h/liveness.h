@@ -40,6 +40,7 @@
 #include "InstructionCache.h"
 #include "bitArray.h"
 #include "ABI.h"
+#include "FunctionSummary.h"
 #include <map>
 #include <set>
 
@@ -68,6 +69,10 @@ class DATAFLOW_EXPORT LivenessAnalyzer{
 
 	void* getPtrToInstruction(ParseAPI::Block *block, Address addr) const;	
 	bool isExitBlock(ParseAPI::Block *block);
+	bool getCalleeSummary(ParseAPI::Block *block, FunctionSummary &summary);
+	void recordSummary(ParseAPI::Function *func);
+	void toBitArray(const std::set<MachRegister> &regs, bitArray &bits);
+	void fromBitArray(const bitArray &bits, std::set<MachRegister> &regs);
 	bool isMMX(MachRegister machReg);
 	MachRegister changeIfMMX(MachRegister machReg);
 	int width;
@@ -510,7 +510,7 @@ class Slicer {
             Predicates &p,
             SliceFrame &cand,
             bool skip,
-            std::map<CacheEdge, std::set<AbsRegion> > & visited,
+            std::map<CacheEdge, AbslocSet> & visited,
             std::unordered_map<Address,DefCache> & single,
             std::unordered_map<Address, DefCache>& cache);
 
@@ -529,7 +529,7 @@ class Slicer {
 
     void removeBlocked(
             SliceFrame & f,
-            std::set<AbsRegion> const& block);
+            AbslocSet const& block);
 
     bool stopSlicing(SliceFrame::ActiveMap& active, 
                      GraphPtr g,
@@ -538,7 +538,7 @@ class Slicer {
 
 
     void markVisited(
-            std::map<CacheEdge, std::set<AbsRegion> > & visited,
+            std::map<CacheEdge, AbslocSet> & visited,
             CacheEdge const& e,
             SliceFrame::ActiveMap const& active);
 
@@ -0,0 +1,54 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+// save_rbx writes rbx but saves and restores it, as a callee-saved
+// register must be; caller keeps a value in rbx across the call.
+
+__asm__(".text\n"
+        ".globl save_rbx\n"
+        ".type save_rbx, @function\n"
+        "save_rbx:\n"
+        "\tpush %rbx\n"
+        "\tmov $1, %rbx\n"
+        "\tpop %rbx\n"
+        "\tret\n"
+        ".size save_rbx, .-save_rbx\n");
+
+long caller(long x) {
+    long r;
+    __asm__ volatile ("mov %1, %%rbx\n\t"
+                      "call save_rbx\n\t"
+                      "mov %%rbx, %0"
+                      : "=r"(r) : "r"(x) : "rbx", "memory");
+    return r;
+}
+
+int main() {
+    return caller(0);
+}
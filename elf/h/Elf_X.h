@@ -125,6 +125,8 @@ class DYNELF_EXPORT Elf_X {
     Elf_X_Shdr &get_shdr(unsigned int i);
 
     bool findDebugFile(std::string origfilename, std::string &output_name, char* &output_buffer, unsigned long &output_buffer_size);
+    // GNU build-id note as a lowercase hex string
+    bool getBuildId(std::string &id);
 
     Dyninst::Architecture getArch() const;
 
@@ -63,6 +63,7 @@ namespace ParseAPI {
 
 class LoopAnalyzer;
 class dominatorCFG;
+class CompactCFG;
 class CodeObject;
 class CFGModifier;
 class ParseData;
@@ -502,6 +503,9 @@ class PARSER_EXPORT Function : public AnnotatableSparse, public boost::lockable_
     void getImmediatePostDominates(Block *A, std::set<Block*> &) const;
     void getAllPostDominates(Block *A, std::set<Block*> &) const;
 
+    /* Immutable index-based view of the CFG (see CompactCFG.h); the
+       snapshot is rebuilt after the function changes */
+    boost::shared_ptr<const CompactCFG> compactCFG() const;
 
     /* Parse updates and obfuscation */
     void setEntryBlock(Block *new_entry);
@@ -612,13 +616,30 @@ class PARSER_EXPORT Function : public AnnotatableSparse, public boost::lockable_
     mutable bool isPostDominatorInfoReady;
     void fillDominatorInfo() const;
     void fillPostDominatorInfo() const;
-    /** set of basic blocks that this basicblock dominates immediately*/
-    mutable std::map<Block*, std::set<Block*>*> immediateDominates;
-    /** basic block which is the immediate dominator of the basic block */
-    mutable std::map<Block*, Block*> immediateDominator;
-    /** same as previous two fields, but for postdominator tree */
-    mutable std::map<Block*, std::set<Block*>*> immediatePostDominates;
-    mutable std::map<Block*, Block*> immediatePostDominator;
+
+    mutable boost::shared_ptr<const CompactCFG> _compact_cfg;
+
+    /** A (post)dominator forest over CompactCFG block ids.  Nodes are
+        numbered in pre- and post-order, so A dominates B iff
+        pre[A] <= pre[B] && post[B] <= post[A]. */
+    struct DomTree {
+        boost::shared_ptr<const CompactCFG> cfg;
+        std::vector<int> idom;          // immediate dominator, -1 at roots
+        std::vector<int> child_begin;   // children of i: children[child_begin[i] .. child_begin[i+1])
+        std::vector<int> children;
+        std::vector<int> pre;
+        std::vector<int> post;
+        std::vector<int> preorder;      // ids in preorder; subtrees are contiguous
+        bool dominates(int a, int b) const {
+            return pre[a] <= pre[b] && post[b] <= post[a];
+        }
+    };
+    mutable DomTree domTree;
+    mutable DomTree postDomTree;
+    int domBlockId(const DomTree &tree, Block *b) const;
+    void setDominatorTree(DomTree &tree, boost::shared_ptr<const CompactCFG> cfg,
+                          const std::vector<int> &idom) const;
+    void getDominatorSubtree(const DomTree &tree, Block *A, std::set<Block*> &d) const;
 
     friend void Edge::uninstall();
     friend class Parser;
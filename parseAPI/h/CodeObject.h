@@ -42,6 +42,9 @@
 #include "ParseContainers.h"
 
 namespace Dyninst {
+
+class AssignmentCache;
+
 namespace ParseAPI {
 
 /** A CodeObject defines a collection of binary code, for example a binary,
@@ -54,9 +57,13 @@ class ParseCallback;
 class ParseCallbackManager;
 class CFGModifier;
 class CodeSource;
+class DecodedInsnCache;
 
 typedef enum {
-    PreambleMatching, IdiomMatching
+    PreambleMatching, IdiomMatching,
+    // IdiomMatching that scores all gaps in parallel and parses the
+    // accepted entries in a single batch
+    ParallelIdiomMatching
 } GapParsingType;
 
 class CodeObject {
@@ -161,6 +168,14 @@ class CodeObject {
      * Hacky "for insertion" method
      */
     PARSER_EXPORT Address getFreeAddr() const;
+
+    /* Decoded instructions of this object's blocks, shared by the
+       parser's consumers; see DecodedInsnCache.h */
+    PARSER_EXPORT DecodedInsnCache & insnCache() { return *_insn_cache; }
+
+    /* Instruction to assignment conversions, shared by the dataflow
+       analyses' AssignmentConverters; see AssignmentCache.h */
+    PARSER_EXPORT AssignmentCache & assignmentCache() { return *_assign_cache; }
     ParseData* parse_data();
 
  private:
@@ -183,6 +198,8 @@ class CodeObject {
     bool owns_factory;
     bool defensive;
     funclist& flist;
+    DecodedInsnCache * _insn_cache;
+    AssignmentCache * _assign_cache;
 };
 
 // We need CFG.h, which is included by this
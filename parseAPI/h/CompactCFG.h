@@ -0,0 +1,115 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#ifndef _PARSEAPI_COMPACT_CFG_H_
+#define _PARSEAPI_COMPACT_CFG_H_
+
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include "dyntypes.h"
+#include "CFG.h"
+#include "Instruction.h"
+
+namespace Dyninst {
+namespace ParseAPI {
+
+/* An immutable, index-based snapshot of a Function's intraprocedural CFG.
+ *
+ * Blocks are numbered densely: blocks reachable from the entry come first
+ * in reverse postorder (so the entry is always 0), followed by any
+ * unreachable blocks in address order.  Successors and predecessors are
+ * stored in CSR form and only cover intraprocedural, non-sink edges.
+ * Analyses can keep their per-block state in plain vectors indexed by
+ * these ids instead of std::map<Block*, ...> side tables.
+ *
+ * A snapshot does not follow later changes to the function; use
+ * Function::compactCFG() to get one that matches the current CFG.
+ */
+class PARSER_EXPORT CompactCFG {
+ public:
+    typedef boost::shared_ptr<const CompactCFG> Ptr;
+
+    /* Build a snapshot of f, which must be finalized.  If decodeInsns is
+       set the instructions of every block are decoded as well. */
+    static Ptr create(const Function *f, bool decodeInsns = false);
+
+    const Function *func() const { return func_; }
+
+    int numBlocks() const { return (int) blocks_.size(); }
+    /* Blocks [0, numReachable()) are reachable from the entry */
+    int numReachable() const { return num_reachable_; }
+    Block *block(int id) const { return blocks_[id]; }
+    /* Returns -1 if b is not part of the function */
+    int id(Block *b) const;
+
+    /* Successor/predecessor ids of a block, and the matching edges */
+    const int *succBegin(int id) const { return succ_.data() + succ_begin_[id]; }
+    const int *succEnd(int id) const { return succ_.data() + succ_begin_[id + 1]; }
+    const int *predBegin(int id) const { return pred_.data() + pred_begin_[id]; }
+    const int *predEnd(int id) const { return pred_.data() + pred_begin_[id + 1]; }
+    int numSuccs(int id) const { return succ_begin_[id + 1] - succ_begin_[id]; }
+    int numPreds(int id) const { return pred_begin_[id + 1] - pred_begin_[id]; }
+    Edge *succEdge(int id, int i) const { return succ_edges_[succ_begin_[id] + i]; }
+    Edge *predEdge(int id, int i) const { return pred_edges_[pred_begin_[id] + i]; }
+
+    /* Exit blocks of the function */
+    const std::vector<int> &exits() const { return exits_; }
+
+    /* Instructions of a block are [insnBegin(id), insnEnd(id)) in
+       insnAddr()/insn(); empty unless the snapshot decoded them */
+    bool hasInsns() const { return !insn_begin_.empty(); }
+    int insnBegin(int id) const { return insn_begin_[id]; }
+    int insnEnd(int id) const { return insn_begin_[id + 1]; }
+    Address insnAddr(int i) const { return insn_addrs_[i]; }
+    const InstructionAPI::Instruction &insn(int i) const { return insns_[i]; }
+
+ private:
+    CompactCFG(const Function *f) : func_(f), num_reachable_(0) {}
+    void build(bool decodeInsns);
+
+    const Function *func_;
+    int num_reachable_;
+    std::vector<Block *> blocks_;
+    dyn_hash_map<Block *, int> ids_;
+    std::vector<int> succ_begin_;
+    std::vector<int> succ_;
+    std::vector<Edge *> succ_edges_;
+    std::vector<int> pred_begin_;
+    std::vector<int> pred_;
+    std::vector<Edge *> pred_edges_;
+    std::vector<int> exits_;
+    std::vector<int> insn_begin_;
+    std::vector<Address> insn_addrs_;
+    std::vector<InstructionAPI::Instruction> insns_;
+};
+
+}
+}
+
+#endif
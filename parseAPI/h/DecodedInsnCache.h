@@ -0,0 +1,115 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+#ifndef _PARSEAPI_DECODED_INSN_CACHE_H_
+#define _PARSEAPI_DECODED_INSN_CACHE_H_
+
+#include <vector>
+#include <utility>
+#include "ShardedLRU.h"
+#include "CFG.h"
+#include "Instruction.h"
+
+namespace Dyninst {
+namespace ParseAPI {
+
+/* A bounded, thread-safe cache of decoded instructions, keyed by the
+ * address range of the block they were decoded from.  Each CodeObject
+ * owns one (CodeObject::insnCache()); Block::getInsns and the dataflow
+ * analyses go through it so a block is decoded once rather than once
+ * per consumer.
+ *
+ * Only the opcode decoding is cached; operands are left undecoded, and
+ * callers get plain copies that decode their own operands on first use.
+ * Analyses bind register values into operand and control flow target
+ * ASTs, so those trees must not be shared between users of the same
+ * block, while the cached instructions themselves are never modified.
+ * Memory use is an estimate based on the number and size of the cached
+ * instructions; when it exceeds the budget the least recently used
+ * blocks are evicted.  A block's entry is dropped when its end moves
+ * (Block::updateEnd), so a split block is decoded again.
+ */
+class PARSER_EXPORT DecodedInsnCache {
+ public:
+    typedef std::vector<std::pair<InstructionAPI::Instruction, Address> > InsnVec;
+
+    struct Stats {
+        unsigned long hits;
+        unsigned long misses;
+        unsigned long evictions;
+        unsigned long entries;
+        size_t bytes;
+    };
+
+    static const size_t default_budget = 64 * 1024 * 1024;
+
+    DecodedInsnCache(size_t budget = default_budget);
+    ~DecodedInsnCache();
+
+    /* Decoded instructions of b, in address order */
+    void getInsns(Block *b, Block::Insns &insns);
+    void getInsns(Block *b, InsnVec &insns);
+
+    /* Drop whatever is cached for b's current address range */
+    void invalidate(Block *b);
+    void clear();
+
+    /* A budget of 0 disables caching */
+    void setBudget(size_t bytes);
+    size_t budget() const;
+    Stats stats() const;
+
+ private:
+    struct Key {
+        CodeRegion *region;
+        Address start;
+        Address end;
+        bool operator==(const Key &o) const {
+            return region == o.region && start == o.start && end == o.end;
+        }
+    };
+    struct KeyHash {
+        size_t operator()(const Key &k) const {
+            return std::hash<Address>()(k.start) ^
+                   (std::hash<Address>()(k.end) << 1) ^
+                   std::hash<void *>()(k.region);
+        }
+    };
+
+    static Key keyFor(Block *b);
+    static void decode(const Key &k, Architecture arch, InsnVec &insns);
+    static size_t footprint(const InsnVec &insns);
+
+    ShardedLRU<Key, InsnVec, KeyHash> lru_;
+};
+
+}
+}
+
+#endif
@@ -23,16 +23,6 @@ using namespace Dyninst::DataflowAPI;
 
 
 
-class SimplifyVisitor: public ASTVisitor {
-    Address addr;
-    bool keepMultiOne;
-    SymbolicExpression &se;
-public:
-    using ASTVisitor::visit;
-    virtual ASTPtr visit(DataflowAPI::RoseAST *ast);
-    SimplifyVisitor(Address a, bool k, SymbolicExpression &sym): addr(a), keepMultiOne(k), se(sym) {}
-};
-
 
 class BoundCalcVisitor: public ASTVisitor {
      
@@ -148,6 +148,7 @@ namespace Dyninst {
             void parse_at(CodeRegion *cr, Address addr, bool recursive, FuncSource src);
 
             void parse_at(Address addr, bool recursive, FuncSource src);
+            void parse_at(CodeRegion *cr, const std::vector<Address> &addrs, bool recursive, FuncSource src);
 
             void parse_edges(vector<ParseWorkElem *> &work_elems);
 
@@ -181,6 +182,7 @@ namespace Dyninst {
 
             bool getGapRange(CodeRegion*, Address, Address&, Address&);
             void probabilistic_gap_parsing(CodeRegion *cr);
+            void parallel_probabilistic_gap_parsing(CodeRegion *cr);
             //void parse_sbp();
 
             ParseFrame::Status frame_status(CodeRegion *cr, Address addr);
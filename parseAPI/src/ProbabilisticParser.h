@@ -150,6 +150,7 @@ public:
 
 class ProbabilityCalculator {
 
+public:
     struct DecodeData {
 	unsigned short entry_id;
 	unsigned short arg1;
@@ -160,6 +161,10 @@ class ProbabilityCalculator {
         DecodeData() : entry_id(0), arg1(0), arg2(0), len(0) {}	    
     };
 
+    // save the idiom extraction results for idiom matching at different addresses 
+    typedef dyn_hash_map<Address, DecodeData > DecodeCache;
+
+private:
     IdiomModel model;
     CodeRegion* cr;
     CodeSource* cs;
@@ -171,14 +176,15 @@ class ProbabilityCalculator {
     
     dyn_hash_set<Function *> finalized;
 
-    // save the idiom extraction results for idiom matching at different addresses 
-    typedef dyn_hash_map<Address, DecodeData > DecodeCache;
     DecodeCache decodeCache;
 
+    // First bytes that can never start a function
+    bool rejectFirstByte[256];
+
     // Recursively mathcing normal idioms and calculate weights
-    double calcForwardWeights(int cur, Address addr, IdiomPrefixTree *tree, bool &valid);
+    double calcForwardWeights(int cur, Address addr, IdiomPrefixTree *tree, bool &valid, DecodeCache &cache);
     // Recursively mathcing prefix idioms and calculate weights
-    double calcBackwardWeights(int cur, Address addr, IdiomPrefixTree *tree, std::set<IdiomPrefixTree*> &matched);
+    double calcBackwardWeights(int cur, Address addr, IdiomPrefixTree *tree, std::set<IdiomPrefixTree*> &matched, DecodeCache &cache);
     // Enforce the overlapping constraints and
     // return true if the cur_addr doesn't conflict with other identified functions,
     // otherwise return false
@@ -188,7 +194,7 @@ class ProbabilityCalculator {
 				       dyn_hash_map<Address, double> &newFEPProb,
 				       dyn_hash_map<Address, double> &newReachingProb,
 				       dyn_hash_set<Function*> &newDiscoveredFuncs);
-    bool decodeInstruction(DecodeData &data, Address addr);
+    bool decodeInstruction(DecodeData &data, Address addr, DecodeCache &cache);
 
     void Finalize(dyn_hash_map<Address, double> &newFEPProb,
                   dyn_hash_map<Address, double> &newReachingProb,
@@ -205,6 +211,12 @@ public:
 		finalized.clear();
 	}
     double calcProbByMatchingIdioms(Address addr);
+    // Same score as calcProbByMatchingIdioms, but records nothing in this
+    // calculator.  Safe to call from several threads, each with its own cache.
+    double scoreAddress(Address addr, DecodeCache &cache);
+    // Cheap check on the first byte at addr, done before any decoding
+    bool passFirstBytePrefilter(Address addr);
+    double getProbThreshold() { return model.getProbThreshold(); }
     void calcProbByEnforcingConstraints();
     double getFEPProb(Address addr);
     bool isFEP(Address addr);
@@ -3,6 +3,7 @@
 
 #include "DynAST.h"
 #include "Absloc.h"
+#include "ASTFactory.h"
 #include "CodeSource.h"
 #include <map>
 using Dyninst::AST;
@@ -13,6 +14,11 @@ class SymbolicExpression {
 
     dyn_hash_map<Assignment::Ptr, AST::Ptr, Assignment::AssignmentPtrHasher> expandCache;
 
+    // Simplified ASTs are hash-consed, so they are shared and must not
+    // be modified in place; simplification results are memoized per node
+    DataflowAPI::ASTFactory factory;
+    AST::Ptr Simplify(AST::Ptr ast, Address addr, bool keepMultiOne);
+
 public:
 
     AST::Ptr SimplifyRoot(AST::Ptr ast, Address addr, bool keepMultiOne = false);
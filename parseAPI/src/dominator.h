@@ -33,7 +33,7 @@
 
 #include "dyntypes.h"
 #include "CFG.h"
-#include <unordered_map>
+#include "CompactCFG.h"
 #include <set>
 
 using namespace std;
@@ -57,13 +57,14 @@ protected:
    dominatorBB *child;
 
    Block *parseBlock;
+   int cfg_id;
    dominatorCFG *dom_cfg;
 
    std::set<dominatorBB *> bucket;
    vector<dominatorBB *> pred;
    vector<dominatorBB *> succ;   
  public:
-   dominatorBB(Block *bb, dominatorCFG *dc);
+   dominatorBB(Block *bb, int id, dominatorCFG *dc);
    ~dominatorBB();
    dominatorBB *eval();
    void compress();
@@ -73,8 +74,8 @@ protected:
 class dominatorCFG {
    friend class dominatorBB;
  protected:
-   std::unordered_map<Address, dominatorBB *> map_;
    const Function *func;
+   CompactCFG::Ptr cfg;
    vector<dominatorBB *> all_blocks;
    vector<dominatorBB *> sorted_blocks;
    int currentDepthNo;
@@ -86,7 +87,8 @@ class dominatorCFG {
    void depthFirstSearch(dominatorBB *v);
    void eval(dominatorBB *v);
    void link(dominatorBB *v, dominatorBB *w);
-   dominatorBB *parseToDomBB(Block *bb);
+   dominatorBB *idToDomBB(int id) { return all_blocks[id + 1]; }
+   void storeResults(bool post);
 
  public:
    dominatorCFG(const Function *f);
@@ -40,6 +40,7 @@
 #include <set>
 #include <map>
 #include <string>
+#include <boost/atomic.hpp>
 
 struct GeneratorMTInternals;
 class int_process;
@@ -86,6 +87,16 @@ class PC_EXPORT Generator
    virtual void setState(state_t newstate);
    virtual state_t getState();
 
+   //Throughput statistics, accumulated since the generator started or
+   // since the last resetStats.  A wakeup is one return from the OS with
+   // one or more events.  Safe to read from any thread while the
+   // generator runs; the counters are not read as one snapshot.
+   unsigned long getNumWakeups() const;
+   unsigned long getNumEvents() const;
+   unsigned long getMaxEventsPerWakeup() const;
+   double getEventsPerSecond() const;
+   void resetStats();
+
  protected:
    //Event handling
    static std::map<Dyninst::PID, Process *> procs;
@@ -123,6 +134,13 @@ class PC_EXPORT Generator
 
   private:
    bool eventBlock_;
+
+   //Written by the generator thread, read by any thread
+   boost::atomic<unsigned long> num_wakeups;
+   boost::atomic<unsigned long> num_events;
+   boost::atomic<unsigned long> max_events_per_wakeup;
+   boost::atomic<long long> stats_start;
+   void updateStats(unsigned long events_in_wakeup);
 };
 
 class PC_EXPORT GeneratorMT : public Generator
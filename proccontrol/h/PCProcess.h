@@ -322,6 +322,13 @@ class PC_EXPORT Process : public boost::enable_shared_from_this<Process>
    static bool setThreadingMode(thread_mode_t tm);
    static thread_mode_t getThreadingMode();
 
+   /**
+    * Number of worker threads used to run event handlers for independent
+    * processes in parallel.  0 or 1 (the default) handles events serially.
+    **/
+   static bool setEventHandlingWorkers(unsigned num_workers);
+   static unsigned getEventHandlingWorkers();
+
    /**
     * Create and attach to new processes
     **/
@@ -474,6 +481,15 @@ class PC_EXPORT Process : public boost::enable_shared_from_this<Process>
    bool writeMemoryAsync(Dyninst::Address addr, const void *buffer, size_t size, void *opaque_val = NULL) const;
    bool readMemoryAsync(void *buffer, Dyninst::Address addr, size_t size, void *opaque_val = NULL) const;
 
+   /**
+    * Opt-in page cache for readMemory.  While every thread is stopped,
+    * reads are served from whole pages cached since the last stop, and
+    * adjacent missing pages are read in one operation.  Writes update the
+    * cache, and any continue drops it.  Not available on async platforms.
+    **/
+   bool setMemoryReadCaching(bool enable);
+   bool getMemoryReadCacheStats(unsigned long &hits, unsigned long &misses) const;
+
    /** 
     * Currently Windows-only, needed for the test infrastructure but possibly useful elsewhere 
     **/
@@ -520,6 +536,18 @@ class PC_EXPORT Process : public boost::enable_shared_from_this<Process>
     **/
 	bool runIRPCAsync(IRPC::ptr irpc);
 
+   /**
+    * Post several IRPCs to one thread.  Their code shares a single
+    * allocation that is written into the process once; otherwise each
+    * IRPC runs, stops and restores registers as with postIRPC.
+    **/
+   bool postIRPCBatch(const std::vector<IRPC::ptr> &rpcs) const;
+
+   /**
+    * Post with postIRPCBatch, run, and wait for all of the IRPCs to complete
+    **/
+   bool runIRPCBatchSync(const std::vector<IRPC::ptr> &rpcs);
+
    /**
     * Symbol access
     **/
@@ -631,6 +659,8 @@ class PC_EXPORT Thread : public boost::enable_shared_from_this<Thread>
    bool postIRPC(IRPC::ptr irpc) const;
    bool runIRPCSync(IRPC::ptr irpc);
    bool runIRPCAsync(IRPC::ptr irpc);
+   bool postIRPCBatch(const std::vector<IRPC::ptr> &rpcs) const;
+   bool runIRPCBatchSync(const std::vector<IRPC::ptr> &rpcs);
 
    bool getPostedIRPCs(std::vector<IRPC::ptr> &rpcs) const;
    IRPC::const_ptr getRunningIRPC() const;
@@ -551,6 +551,12 @@ class PC_EXPORT ThreadSet : public boost::enable_shared_from_this<ThreadSet> {
    bool postIRPC(const std::multimap<Thread::const_ptr, IRPC::ptr> &rpcs) const;
    bool postIRPC(IRPC::ptr irpc, std::multimap<Thread::ptr, IRPC::ptr> *result = NULL) const;
 
+   /**
+    * Post IRPCs so that each thread's IRPCs share a single code allocation
+    * (see Process::postIRPCBatch).
+    **/
+   bool postIRPCBatch(const std::multimap<Thread::const_ptr, IRPC::ptr> &rpcs) const;
+
    /**
     * Perform specific operations.  Interface objects will only be returned
     * on appropriately supported platforms, others will return NULL.
@@ -30,6 +30,7 @@
 
 #include "Handler.h"
 #include "PCProcess.h"
+#include "common/src/dthread.h"
 #include <map>
 #include <vector>
 
@@ -57,7 +58,8 @@ class HandlerPool
    ~HandlerPool();
 
    void addHandler(Handler *handler);
-   bool handleEvent(Event::ptr ev);
+   bool handleEvent(Event::ptr ev, bool defer_callbacks = false, bool *deferred = NULL);
+   bool canHandleInParallel(Event::ptr ev) const;
    Event::ptr handleAsyncEvent(Event::ptr ev);
 
    void notifyOfPendingAsyncs(const std::set<response::ptr> &asyncs, Event::ptr ev);
@@ -99,6 +101,45 @@ class HandlerPool
    static Mutex<false> asyncPendingLock;
 };
 
+/**
+ * Worker threads that run the handlers of events from independent processes
+ * concurrently.  The dispatching thread (the one in waitAndHandleEvents)
+ * hands over at most one event per process at a time, so per-process and
+ * per-thread ordering are preserved.  Workers stop before the callback
+ * handlers of any event that has user callbacks; the dispatching thread
+ * finishes those events serially, in dequeue order.
+ **/
+class HandlerWorkers
+{
+ public:
+   struct work_t {
+      Event::ptr ev;
+      HandlerPool *hpool;
+      bool deferred;
+   };
+
+   static HandlerWorkers *workers();
+   static bool setNumWorkers(unsigned num);
+   static unsigned getNumWorkers();
+
+   void handleBatch(std::vector<work_t> &work);
+   static void worker_main_wrapper(void *w);
+ private:
+   HandlerWorkers(unsigned num);
+   ~HandlerWorkers();
+
+   void worker_main();
+
+   std::vector<DThread *> threads;
+   CondVar<> cond;
+   std::vector<work_t> *cur_work;
+   unsigned next_item;
+   unsigned items_done;
+   bool should_exit;
+
+   static HandlerWorkers *the_workers;
+};
+
 class HandlePreBootstrap : public Handler
 {
  public:
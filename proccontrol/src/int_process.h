@@ -356,6 +356,9 @@ class int_process
    virtual void freeExecMemory(Dyninst::Address addr);
 
    static bool waitAndHandleEvents(bool block);
+   static bool handleDequeuedEvent(Event::ptr ev);
+   static bool handleEventBatch(Event::ptr first_ev);
+   static bool canJoinEventBatch(Event::ptr ev, const std::set<int_process *> &batch_procs);
    static bool waitAndHandleForProc(bool block, int_process *proc, bool &proc_exited);
    static bool waitForAsyncEvent(response::ptr resp);
    static bool waitForAsyncEvent(std::set<response::ptr> resp);
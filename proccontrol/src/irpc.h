@@ -34,6 +34,7 @@
 #include <map>
 #include <list>
 #include <set>
+#include <vector>
 
 #include "common/h/dyntypes.h"
 #include "Handler.h"
@@ -69,6 +70,7 @@ class iRPCAllocation
 	  // HACK: affirmatively set that we do need a data save. If we've just allocated space, why save the data?
       needs_datasave(false),
       have_saved_regs(false),
+      is_arena(false),
       ref_count(0)
       {
       }
@@ -84,6 +86,9 @@ class iRPCAllocation
    void *orig_data;
    bool needs_datasave;
    bool have_saved_regs;
+   //True if this allocation holds the code arena of an iRPC batch.
+   // Arena allocations are never hijacked by unrelated iRPCs.
+   bool is_arena;
    int ref_count;
 
    //These are NULL if the user handed us memory to run the iRPC in.
@@ -91,6 +96,30 @@ class iRPCAllocation
    boost::weak_ptr<int_iRPC> deletion_irpc;
 };
 
+//The code of every iRPC in a batch, laid out back-to-back.  The arena is
+// written into the process once, by the first iRPC of the batch to run.
+class iRPCArena
+{
+   friend void boost::checked_delete<iRPCArena>(iRPCArena *) CHECKED_DELETE_NOEXCEPT;
+  public:
+   typedef boost::shared_ptr<iRPCArena> ptr;
+   iRPCArena() :
+      blob(NULL),
+      size(0),
+      written(false)
+   {
+   }
+   ~iRPCArena()
+   {
+      if (blob)
+         free(blob);
+   }
+
+   void *blob;
+   unsigned long size;
+   bool written;
+};
+
 class int_iRPC : public boost::enable_shared_from_this<int_iRPC>
 {
    friend void boost::checked_delete<int_iRPC>(int_iRPC *) CHECKED_DELETE_NOEXCEPT;   
@@ -184,6 +213,10 @@ class int_iRPC : public boost::enable_shared_from_this<int_iRPC>
    void setDirectFree(bool s) { directFree_ = s; }
    bool directFree() const { return directFree_; }
 
+   iRPCArena::ptr arena() const;
+   unsigned long arenaOffset() const;
+   void setArena(iRPCArena::ptr a, unsigned long offset);
+
    void getPendingResponses(std::set<response::ptr> &resps);
    void syncAsyncResponses(bool is_sync);
 
@@ -199,6 +232,7 @@ class int_iRPC : public boost::enable_shared_from_this<int_iRPC>
    void setRestoreToState(int_thread::State s);
  private:
    static unsigned long next_id;
+   static Mutex<> id_lock;
    unsigned long my_id;
    State state;
    Type type;
@@ -223,9 +257,17 @@ class int_iRPC : public boost::enable_shared_from_this<int_iRPC>
    result_response::ptr pcset_result;
    bool directFree_;
    void *user_data;
+   iRPCArena::ptr arena_;
+   unsigned long arena_offset;
 };
 
 //Singleton class, only one of these across all processes.
+/**
+ * iRPCMgr keeps no state of its own.  RPC queues live on each int_thread
+ * and are only touched by the handler for that thread's process, and the
+ * sync RPC counts go through Counter, which locks.  That is what lets
+ * HandlerWorkers run iRPC handlers for different processes at once.
+ **/
 class iRPCMgr
 {
    friend class iRPC;
@@ -236,9 +278,12 @@ class iRPCMgr
 
    unsigned numActiveRPCs(int_thread *thr);
    iRPCAllocation::ptr findAllocationForRPC(int_thread *thread, int_iRPC::ptr rpc);
+   int_thread *selectThreadForRPC(int_process *proc, int_iRPC::ptr rpc);
    
    bool postRPCToProc(int_process *proc, int_iRPC::ptr rpc);
    bool postRPCToThread(int_thread *thread, int_iRPC::ptr rpc);
+   bool postRPCBatchToProc(int_process *proc, const std::vector<int_iRPC::ptr> &rpcs);
+   bool postRPCBatchToThread(int_thread *thread, const std::vector<int_iRPC::ptr> &rpcs);
    int_thread *createThreadForRPC(int_process* proc, int_thread* best_candidate);
 
    int_iRPC::ptr createInfMallocRPC(int_process *proc, unsigned long size, bool use_addr, Dyninst::Address addr);
@@ -60,6 +60,20 @@ class GeneratorLinux : public GeneratorMT
    int generator_lwp;
    int generator_pid;
 
+   //With DYNINST_PROCCONTROL_EPOLL set, the generator blocks in epoll on a
+   // SIGCHLD signalfd (and a wakeup eventfd) instead of in waitpid, and
+   // harvests every pending stop with non-blocking waitpids per wakeup.
+   // Needs SIGCHLD blocked in every thread, see blockSIGCHLDAtLoad.
+   bool use_epoll;
+   int epoll_fd;
+   int signal_fd;
+   int wake_fd;
+   bool initEpoll();
+   void closeEpoll();
+
+  protected:
+   virtual bool getMultiEvent(bool block, std::vector<ArchEvent *> &events);
+
   public:
    GeneratorLinux();
    virtual ~GeneratorLinux();
@@ -77,6 +77,12 @@ typedef enum {
  * 
  * Update - The memcache can now store registers.  Just what
  * every memcache needs.
+ *
+ * Update - The memcache also holds an opt-in page cache for
+ * ordinary synchronous reads (readPages).  Unlike the operation
+ * log above, the page cache has normal memory semantics: it is
+ * only filled while every thread is stopped, writes go through
+ * to it, and it is dropped when any thread continues.
  **/
 class memCache;
 class memEntry {
@@ -130,10 +136,17 @@ class memCache {
    int operation_num;
    std::map<int_thread *, allreg_response::ptr> regs;
 
+   typedef std::map<Dyninst::Address, char *> page_cache_t;
+   page_cache_t page_cache;
+   bool page_cache_enabled;
+   unsigned long page_cache_hits;
+   unsigned long page_cache_misses;
+   unsigned int page_size;
+
    async_ret_t doOperation(memEntry *me, int_thread *op_thread);
    async_ret_t getExistingOperation(mcache_t::iterator i, memEntry *orig);   
    async_ret_t lookupAsync(memEntry *me, int_thread *op_thread);
-   void updateReadCacheWithWrite(Address dest, char *src, unsigned long size);
+   bool fillPages(Dyninst::Address start, unsigned long num_pages, int_thread *thrd);
   public:
    memCache(int_process *p);
    ~memCache();
@@ -151,6 +164,15 @@ class memCache {
    void setSyncHandling(bool b);
    void markToken(token_t tk);
    void condense();
+   void updateReadCacheWithWrite(Dyninst::Address dest, const char *src, unsigned long size);
+
+   void setPageCaching(bool b);
+   bool pageCachingEnabled() const;
+   bool canUsePageCache();
+   bool readPages(void *dest, Dyninst::Address src, unsigned long size, int_thread *thrd = NULL);
+   void invalidatePages(Dyninst::Address addr, unsigned long size);
+   void clearPages();
+   void getPageCacheStats(unsigned long &hits, unsigned long &misses) const;
 
   private:
    async_ret_t readMemoryAsync(void *dest, Dyninst::Address src, unsigned long size, 
@@ -0,0 +1,15 @@
+/* Mutatee for handlerworkers: hits bp_target a fixed number of times */
+volatile int count;
+
+void __attribute__((noinline)) bp_target(void)
+{
+  count++;
+}
+
+int main(void)
+{
+  int i;
+  for (i = 0; i < 200; i++)
+    bp_target();
+  return 0;
+}
@@ -75,9 +75,20 @@ class AnalysisStepperImpl : public FrameStepper
    static std::map<std::string, ParseAPI::CodeObject *> objs;
    static std::map<std::string, ParseAPI::CodeSource*> srcs;
    static std::map<std::string, SymReader*> readers;
+   // Number of steppers that have used each file in the maps above
+   static std::map<std::string, unsigned> users;
+   // The files this stepper has used
+   std::set<std::string> files;
    
-   static ParseAPI::CodeObject *getCodeObject(std::string name);
+   // objs, srcs and readers are shared by the steppers of every process
+   // and thread; these accessors take the lock that guards them.  A file's
+   // entries are freed, and the file closed, once every stepper that used
+   // it is gone.
+   ParseAPI::CodeObject *getCodeObject(std::string name);
    static ParseAPI::CodeSource *getCodeSource(std::string name);
+   SymReader *getSymReader(std::string name);
+   void useFile(const std::string &name);
+   static void releaseFile(const std::string &name);
 
    std::set<height_pair_t> analyzeFunction(std::string name, Offset off);
    std::vector<registerState_t> fullAnalyzeFunction(std::string name, Offset off);
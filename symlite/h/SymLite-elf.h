@@ -33,6 +33,8 @@
 #include "common/src/headers.h"
 
 #include <map>
+#include <vector>
+#include <string.h>
 
 namespace Dyninst {
 
@@ -68,6 +70,34 @@ class SYMLITE_EXPORT SymElf : public Dyninst::SymReader
    void createSymCache();
    Symbol_t lookupCachedSymbol(Dyninst::Offset offset);
    
+   // Name lookup. A symbol section with a GNU or SysV hash section
+   // (.dynsym) is searched through it; any other (.symtab) gets an
+   // in-memory index of its defined symbols on first use.
+   struct CStrHash {
+      size_t operator()(const char *s) const;
+   };
+   struct CStrEq {
+      bool operator()(const char *a, const char *b) const { return strcmp(a, b) == 0; }
+   };
+   typedef dyn_hash_map<const char *, unsigned, CStrHash, CStrEq> NameMap;
+   struct SymNameTable {
+      Elf_X_Shdr *shdr;
+      Elf_X_Sym syms;
+      const char *strs;
+      const uint32_t *gnu_hash;
+      size_t gnu_hash_size;
+      const uint32_t *sysv_hash;
+      size_t sysv_hash_size;
+      NameMap *names;
+   };
+   std::vector<SymNameTable> name_tables;
+   bool name_tables_created;
+
+   void createNameTables();
+   bool lookupName(SymNameTable &t, const char *name, unsigned &idx);
+   bool lookupGnuHash(SymNameTable &t, const char *name, unsigned &idx);
+   bool lookupSysvHash(SymNameTable &t, const char *name, unsigned &idx);
+
    void init();
    unsigned long getSymOffset(const Elf_X_Sym &symbol, unsigned idx);   
    unsigned long getSymTOC(const Elf_X_Sym &symbol, unsigned idx);   
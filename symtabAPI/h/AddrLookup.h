@@ -41,12 +41,32 @@ class LoadedLib;
 
 namespace SymtabAPI {
 
+class Function;
+class FunctionBase;
+class Statement;
+
 typedef struct {
    std::string name;
    Address codeAddr;
    Address dataAddr;
 } LoadedLibrary;
 
+/**
+ * One row of AddressLookup::symbolize's result table.  tab is NULL if the
+ * address is not in any loaded object; the remaining fields are NULL when
+ * that piece of information is not available.  inlined is the innermost
+ * inlined instance at the address (or func itself); the rest of the inline
+ * chain is reached through FunctionBase::getInlinedParent.
+ **/
+typedef struct {
+   Symtab *tab;
+   Offset off;
+   Symbol *sym;
+   Function *func;
+   FunctionBase *inlined;
+   const Statement *line;
+} SymbolizedAddress;
+
 class SYMTAB_EXPORT AddressLookup : public AnnotatableSparse
 {
  private:
@@ -72,6 +92,14 @@ class SYMTAB_EXPORT AddressLookup : public AnnotatableSparse
 
    bool getSymbol(Address addr, Symbol* &sym, Symtab* &tab, bool close = false);
    bool getOffset(Address addr, Symtab* &tab, Offset &off);
+
+   // Batch form of getSymbol that also answers the function, inline chain
+   // and source line.  results[i] describes addrs[i].  The addresses are
+   // grouped by loaded object and each object is searched once, with
+   // repeated addresses resolved only once.  Returns false if none of the
+   // addresses could be placed in a loaded object.
+   bool symbolize(const std::vector<Address> &addrs,
+                  std::vector<SymbolizedAddress> &results);
    
    bool getAllSymtabs(std::vector<Symtab *> &tabs);
    bool getLoadAddress(Symtab* sym, Address &load_addr);
@@ -100,6 +100,18 @@ class SYMTAB_EXPORT Archive : public AnnotatableSparse {
        */
       bool parseMember(Symtab *&img, ArchiveMember *member);
 
+      /**
+       * This method is architecture specific
+       *
+       * Parses the given unparsed members, building their Symtab objects
+       * in parallel.
+       *
+       * Post-condition:
+       *        sets serr and errMsg if there is an error 
+       *        sets Symtab field of each member that parsed
+       */
+      bool parseMembers(std::vector<ArchiveMember *> &members);
+
       /**
        * This method is architecture specific
        *
@@ -108,6 +120,10 @@ class SYMTAB_EXPORT Archive : public AnnotatableSparse {
        */
       bool parseSymbolTable();      
 
+      typedef std::pair<const char *, ArchiveMember *> SymbolEntry;
+      typedef std::vector<SymbolEntry>::const_iterator SymbolIter;
+      std::pair<SymbolIter, SymbolIter> findSymbol(const std::string &name);
+
       MappedFile *mf;
 
       //architecture specific data - 
@@ -116,10 +132,14 @@ class SYMTAB_EXPORT Archive : public AnnotatableSparse {
 
       dyn_hash_map<std::string, ArchiveMember *> membersByName;
       dyn_hash_map<Offset, ArchiveMember *> membersByOffset;
-      std::multimap<std::string, ArchiveMember *> membersBySymbol;
+
+      // The archive symbol table, sorted by name and otherwise in table
+      // order.  Names point into the table libelf keeps for the archive.
+      std::vector<SymbolEntry> membersBySymbol;
 
       // The symbol table is lazily parsed
       bool symbolTableParsed;
+      dyn_mutex symbolTableLock;
 
       // A vector of all Archives. Used to avoid duplicating
       // an Archive that already exists.
@@ -41,6 +41,7 @@
 #include "Variable.h"
 #include "IBSTree.h"
 #include "concurrent.h"
+#include <boost/atomic.hpp>
 
 SYMTAB_EXPORT std::ostream &operator<<(std::ostream &os, const Dyninst::SymtabAPI::Function &);
 
@@ -99,6 +100,14 @@ class SYMTAB_EXPORT FunctionBase
    FunctionBase *getInlinedParent();
    const InlineCollection &getInlines();
 
+   // The ranges of this function's direct inlines, sorted by start, and
+   // the inline among them that covers offset (NULL if none).  The sorted
+   // ranges are built on first use and rebuilt if an inline, or an
+   // inline's ranges, are added later; a reference to an older table
+   // stays valid until the function is destroyed.
+   const FuncRangeCollection &getInlineRanges();
+   FunctionBase *getInlineAt(Offset offset);
+
    const FuncRangeCollection &getRanges();
 
    /***** Frame Pointer Information *****/
@@ -141,6 +150,10 @@ class SYMTAB_EXPORT FunctionBase
    dyn_mutex inlines_lock;
    InlineCollection inlines;
    FunctionBase *inline_parent;
+   boost::atomic<FuncRangeCollection *> inline_ranges_;
+   std::vector<FuncRangeCollection *> retired_inline_ranges_;   // under inlines_lock
+   unsigned inline_ranges_gen_;                                 // under inlines_lock
+   void retireInlineRanges();
 
    dyn_mutex ranges_lock;
    FuncRangeCollection ranges;
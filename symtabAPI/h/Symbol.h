@@ -269,7 +269,20 @@ class SYMTAB_EXPORT Symbol : public AnnotatableSparse
 
    Aggregate *   aggregate_; // Pointer to Function or Variable container, if appropriate.
 
-   std::string mangledName_;
+   // A counted reference to a name in the process-wide NamePool.  Equal
+   // names share storage; a name is freed with its last reference.
+   class SYMTAB_EXPORT PooledName {
+     public:
+      explicit PooledName(const std::string &name);
+      PooledName(const PooledName &other);
+      PooledName &operator=(const PooledName &other);
+      ~PooledName();
+      const char *c_str() const { return str_; }
+      bool operator==(const PooledName &other) const { return str_ == other.str_; }
+     private:
+      const char *str_;
+   };
+   PooledName mangledName_;
 
    SymbolTag     tag_;
    int index_;
@@ -277,8 +290,6 @@ class SYMTAB_EXPORT Symbol : public AnnotatableSparse
 
    bool          isCommonStorage_;
 
-   std::vector<std::string> verNames_;
-
    bool versionHidden_;
 };
 
@@ -32,6 +32,7 @@
 #define __SYMTAB_H__
 
 #include <set>
+#include <list>
 
 #include "Symbol.h"
 #include "Module.h"
@@ -92,6 +93,57 @@ typedef IBSTree< ModRange > ModRangeLookup;
 typedef IBSTree<FuncRange> FuncRangeLookup;
 typedef Dyninst::ProcessReader MemRegReader;
 
+class AddressIndex;
+class SymbolNameIndex;
+
+/**
+ * Usage of the process-wide Symtab cache; see Symtab::setCacheLimit.
+ * The byte counts are estimates of the memory held by the Symtabs.
+ * name_pool_bytes is the storage of the process-wide symbol name pool.
+ * Names are shared between Symtabs, so they are counted there rather than
+ * in any one Symtab's estimate.
+ **/
+struct SYMTAB_EXPORT SymtabCacheStats {
+   SymtabCacheStats() : open(0), cached(0), open_bytes(0), cached_bytes(0),
+                        hits(0), misses(0), evictions(0), name_pool_bytes(0) {}
+   unsigned open;
+   unsigned cached;
+   size_t open_bytes;
+   size_t cached_bytes;
+   unsigned long hits;
+   unsigned long misses;
+   unsigned long evictions;
+   size_t name_pool_bytes;
+};
+
+/**
+ * Cost of one phase of parsing a file.  The page fault counts are for the
+ * whole process over the phase, so phases that overlap (or other threads'
+ * work) are included.
+ **/
+struct SYMTAB_EXPORT LoadPhaseStats {
+   LoadPhaseStats() : seconds(0.0), minor_faults(0), major_faults(0) {}
+   std::string name;
+   double seconds;
+   long minor_faults;
+   long major_faults;
+};
+
+/**
+ * Everything a Symtab knows about one address, as returned by
+ * Symtab::lookupAddress(es).  Fields are NULL where nothing covers
+ * the address.  'inlined' is the innermost (possibly inlined) function
+ * and 'function' is the top-level function containing it.
+ **/
+struct SYMTAB_EXPORT AddressInfo {
+   AddressInfo() : region(NULL), module(NULL), function(NULL), inlined(NULL), symbol(NULL) {}
+   Region *region;
+   Module *module;
+   Function *function;
+   FunctionBase *inlined;
+   Symbol *symbol;
+};
+
 class SYMTAB_EXPORT Symtab : public LookupInterface,
                public AnnotatableSparse
 {
@@ -131,6 +183,40 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
    static Symtab *findOpenSymtab(std::string filename);
    static bool closeSymtab(Symtab *);
 
+   // openFile shares one Symtab per file among all its users.  A file is
+   // identified by its path plus device, inode, size and modification
+   // time, so a rebuilt file is parsed again.  Closed Symtabs are kept, up
+   // to limit bytes (approximate), and reused if the file is reopened; the
+   // least recently closed are freed first.  A limit of 0 (the default)
+   // frees Symtabs as soon as they are closed.  Byte counts in the stats
+   // are estimates taken when each Symtab was opened or closed.
+   //
+   // Symbol names are interned in a process-wide pool shared by all
+   // Symtabs; a name is freed once no remaining Symbol uses it.  The
+   // limit does not cover the pool (see name_pool_bytes).
+   //
+   // The estimates cover only the Symtabs themselves.  Structures built
+   // on top of them, e.g. ParseAPI CodeObjects or DWARF frame parsers,
+   // are not counted, and a Symtab stays open (and so is not evictable)
+   // while its users hold it; the StackwalkerAPI analysis stepper closes
+   // its files when its Walkers are destroyed.
+   static void setCacheLimit(size_t limit);
+   static void getCacheStats(SymtabCacheStats &stats);
+
+   // How files opened afterwards are read, as a mask of IOPolicy bits.
+   // IOHints (the default) gives the kernel access-pattern hints per
+   // section: tables parsed front to back are read ahead, debug info is
+   // marked for random access.  IOPopulate reads whole files ahead when
+   // they are mapped.  IOReleaseParsed drops the pages of the symbol,
+   // string, exception and relocation tables once they are parsed.
+   enum IOPolicy {
+      IOHints = 0x1,
+      IOPopulate = 0x2,
+      IOReleaseParsed = 0x4
+   };
+   static void setIOPolicy(unsigned policy);
+   static unsigned getIOPolicy();
+
     bool exportXML(std::string filename);
    bool exportBin(std::string filename);
    static Symtab *importBin(std::string filename);
@@ -158,8 +244,25 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
    virtual bool getAllSymbolsByType(std::vector<Symbol *> &ret, 
          Symbol::SymbolType sType);
 
+   // Batch form of findSymbol with isRegex set; ret[i] receives the
+   // matches for patterns[i].  Both forms search a name index built on
+   // the first wildcard query.
+   bool findSymbolsByPatterns(std::vector<std::vector<Symbol *> > &ret,
+                              const std::vector<std::string> &patterns,
+                              Symbol::SymbolType sType = Symbol::ST_UNKNOWN,
+                              NameType nameType = anyName,
+                              bool checkCase = false);
+
    std::vector<Symbol *> findSymbolByOffset(Offset);
 
+   // Converts the symbol indices into a compact, read-only form.  Done
+   // automatically once the file is parsed; adding, deleting or moving a
+   // symbol thaws them again.  Freezing is not safe against concurrent
+   // lookups.  Thawing is, as far as adding a symbol goes: the frozen
+   // tables are kept until the Symtab is destroyed.
+   void freezeSymbolIndex();
+   bool isSymbolIndexFrozen() const;
+
    // Return all undefined symbols in the binary. Currently used for finding
    // the .o's in a static archive that have definitions of these symbols
    bool getAllUndefinedSymbols(std::vector<Symbol *> &ret);
@@ -181,6 +284,12 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
    bool getContainingFunction(Offset offset, Function* &func);
    //Searches for functions and returns inlined instances
    bool getContainingInlinedFunction(Offset offset, FunctionBase* &func);
+   // The inline call stack at offset, innermost first and ending with the
+   // containing Function.  Each function's inlines are indexed by range
+   // on first use; buildInlineIndices does that up front, in parallel, for
+   // funcs (every function if empty).
+   bool getInlineStack(Offset offset, std::vector<FunctionBase *> &stack);
+   void buildInlineIndices(const std::vector<Function *> &funcs = std::vector<Function *>());
 
    // Variable
    bool findVariableByOffset(Variable *&ret, const Offset offset);
@@ -210,6 +319,14 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
    bool findRegionByEntry(Region *&ret, const Offset offset);
    Region *findEnclosingRegion(const Offset offset);
 
+   // Address index
+   // Answers region, module, function, inlined function and symbol
+   // queries with one search over an immutable index, built on first
+   // use and rebuilt after the Symtab is modified.  lookupAddresses is
+   // fastest when the offsets are sorted.
+   bool lookupAddress(Offset offset, AddressInfo &info);
+   bool lookupAddresses(const std::vector<Offset> &offsets, std::vector<AddressInfo> &infos);
+
    // Exceptions
    bool findException(ExceptionBlock &excp,Offset addr);
    bool getAllExceptions(std::vector<ExceptionBlock *> &exceptions);
@@ -236,8 +353,14 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
    /*****Query Functions*****/
    bool isExec() const;
    bool isStripped();
+   // GNU build-id as a hex string; false if the object has none
+   bool getBuildId(std::string &id);
    ObjectType getObjectType() const;
    Dyninst::Architecture getArchitecture() const;
+   // Wall-clock seconds spent in each phase of parsing the file, in the
+   // order the phases finished; false if no timings were recorded
+   bool getLoadPhaseTimes(std::vector<std::pair<std::string, double> > &times) const;
+   bool getLoadPhaseStats(std::vector<LoadPhaseStats> &stats) const;
    bool isCode(const Offset where) const;
    bool isData(const Offset where) const;
    bool isValidOffset(const Offset where) const;
@@ -459,7 +582,7 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
    void rebase(Offset offset);
 
  private:
-   void createDefaultModule();
+   Module *createDefaultModule();
 
    Module *newModule(const std::string &name, const Offset addr, supportedLanguages lang);
    
@@ -516,9 +639,30 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
    std::vector<Segment> segments_;
    //  make sure is_a_out is set before calling symbolsToFunctions
 
+   // A file's device, inode, size and modification time, from stat
+   struct file_identity {
+      file_identity() : dev(0), ino(0), size(0), mtime(0) {}
+      bool read(const std::string &path);
+      bool operator==(const file_identity &o) const {
+         return dev == o.dev && ino == o.ino && size == o.size && mtime == o.mtime;
+      }
+      unsigned long long dev, ino, size;
+      long long mtime;
+   };
+
    // A std::vector of all Symtabs. Used to avoid duplicating
-   // a Symtab that already exists.
+   // a Symtab that already exists.  Closed Symtabs kept for reuse stay in
+   // it with a zero reference count and are also listed, most recently
+   // closed first, in cachedSymtabs.  Both are guarded by allSymtabsLock.
    static std::vector<Symtab *> allSymtabs;
+   static std::list<Symtab *> cachedSymtabs;
+   static dyn_mutex allSymtabsLock;
+   // id is the file's identity, read before taking the lock, or NULL if
+   // it could not be read
+   static Symtab *findOpenSymtabLocked(const std::string &filename, const file_identity *id,
+                                       bool count_hit = true);
+   static void trimCache(std::vector<Symtab *> &victims);
+   size_t estimateMemoryUsage() const;
    std::string defaultNamespacePrefix;
 
    //sections
@@ -546,35 +690,94 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
        by_name_t by_pretty;
        by_name_t by_typed;
 
-       // Only inserts if not present. Returns whether it inserted.
+       // Immutable replacement for the maps above, built by freeze().
+       // Symbols are sorted by offset and each name index is an open
+       // addressing table over a pool of distinct names.
+       struct frozen_names_t {
+           std::string pool;              // NUL-terminated distinct names
+           std::vector<uint32_t> name;    // per name: offset into pool
+           std::vector<uint32_t> hash;    // per name: hash of the name
+           std::vector<uint32_t> first;   // per name, plus one: into syms
+           symvec_t syms;
+           std::vector<uint32_t> slots;   // name index + 1, 0 if empty
+
+           void build(by_name_t &m);
+           bool find(const std::string &n, symvec_t &ret) const;
+       };
+       struct frozen_t {
+           std::vector<Offset> offsets;
+           symvec_t syms;                 // parallel to offsets
+           frozen_names_t by_mangled;
+           frozen_names_t by_pretty;
+           frozen_names_t by_typed;
+       };
+
+       indexed_symbols() : frozen(NULL) {}
+       ~indexed_symbols();
+
+       // Only inserts if not present. Returns whether it inserted.  Safe
+       // to use in parallel with lookups and other inserts.
        bool insert(Symbol* s);
 
-       // Clears the table. Do not use in parallel.
+       // Clears the table and frees retired frozen forms. Do not use in
+       // parallel.
        void clear();
 
        // Erases symbols from the table. Do not use in parallel.
        void erase(Symbol* s);
 
+       // Moves a symbol to a new offset. Do not use in parallel.
+       void move(Symbol* s, Offset newOffset);
+
+       // Lookups; append to ret and return whether anything matched.
+       bool find_by_offset(Offset o, symvec_t &ret) const;
+       bool find_by_mangled(const std::string &n, symvec_t &ret) const;
+       bool find_by_pretty(const std::string &n, symvec_t &ret) const;
+       bool find_by_typed(const std::string &n, symvec_t &ret) const;
+
+       // Switch between the maps and the frozen form.  freeze() must not
+       // run in parallel with lookups.  thaw() may: a lookup can still be
+       // walking the frozen form, so it is retired rather than freed.
+       void freeze();
+       void thaw();
+       bool is_frozen() const { return frozen.load() != NULL; }
+
        // Iterator for the symbols. Do not use in parallel.
        class iterator : public std::iterator<std::forward_iterator_tag,Symbol*> {
            master_t::iterator m;
+           Symbol* const* f;   // set while iterating the frozen form
        public:
-           iterator(master_t::iterator i) : m(i) {};
+           iterator(master_t::iterator i) : m(i), f(NULL) {};
+           iterator(Symbol* const* p) : f(p) {};
            ~iterator() {};
-           bool operator==(const iterator& x) { return m == x.m; };
+           bool operator==(const iterator& x) { return f ? f == x.f : m == x.m; };
            bool operator!=(const iterator& x) { return !operator==(x); };
-           Symbol* const& operator*() const { return m->first; };
+           Symbol* const& operator*() const { return f ? *f : m->first; };
            Symbol* const* operator->() const { return &operator*(); };
-           iterator& operator++() { ++m; return *this; };
+           iterator& operator++() { if (f) ++f; else ++m; return *this; };
            iterator operator++(int) {
-               iterator old(m);
+               iterator old(*this);
                operator++();
                return old;
            }
        };
 
-       iterator begin() { return iterator(master.begin()); }
-       iterator end() { return iterator(master.end()); }
+       iterator begin() {
+           frozen_t *fz = frozen.load();
+           return fz ? iterator(&fz->syms[0]) : iterator(master.begin());
+       }
+       iterator end() {
+           frozen_t *fz = frozen.load();
+           return fz ? iterator(&fz->syms[0] + fz->syms.size()) : iterator(master.end());
+       }
+
+   private:
+       boost::atomic<frozen_t *> frozen;
+       std::vector<frozen_t *> retired;   // thawed, freed with the table
+       dyn_mutex freeze_lock;
+
+       indexed_symbols(const indexed_symbols &);
+       indexed_symbols &operator=(const indexed_symbols &);
    };
 
    indexed_symbols everyDefinedSymbol;
@@ -641,6 +844,17 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
 
    FuncRangeLookup *func_lookup;
     ModRangeLookup *mod_lookup_;
+   std::vector<ModRange *> mod_ranges_;
+
+   boost::shared_ptr<AddressIndex> addr_index_;
+   dyn_mutex addr_index_lock_;
+   boost::shared_ptr<AddressIndex> getAddressIndex();
+   void invalidateAddressIndex();
+
+   boost::shared_ptr<SymbolNameIndex> name_index_;
+   dyn_mutex name_index_lock_;
+   boost::shared_ptr<SymbolNameIndex> getSymbolNameIndex();
+   void invalidateSymbolNameIndex();
 
    //Don't use obj_private, use getObject() instead.
  public:
@@ -662,6 +876,14 @@ class SYMTAB_EXPORT Symtab : public LookupInterface,
 
  private:
     unsigned _ref_cnt;
+
+    // Identity of the file this Symtab was parsed from, taken when it
+    // was opened; all zero for in-memory images.
+    file_identity file_id_;
+    // estimateMemoryUsage(), taken when the Symtab is opened (before other
+    // threads can see it) and again when its last user closes it, so the
+    // cache statistics never walk a Symtab that is being modified
+    size_t cache_bytes_;
 };
 
 /**
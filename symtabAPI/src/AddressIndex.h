@@ -0,0 +1,88 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#if !defined(_Address_Index_h_)
+#define _Address_Index_h_
+
+#include "Symtab.h"
+#include <vector>
+
+namespace Dyninst {
+namespace SymtabAPI {
+
+/**
+ * An immutable address index over a Symtab's regions, modules,
+ * functions, inlined functions and sized symbols.
+ *
+ * All ranges are flattened into one sorted array of disjoint segments,
+ * each carrying the innermost entity of every kind that covers it.  A
+ * lookup is then a single predecessor search over segment starts, kept
+ * in Eytzinger (BFS) order so the top levels of the search share cache
+ * lines.  Sorted batches are answered with a merge walk instead.
+ **/
+class AddressIndex
+{
+ public:
+   template <class T>
+   struct Range {
+      Range(Offset l, Offset h, T *p) : low(l), high(h), payload(p) {}
+      Offset low;
+      Offset high;
+      T *payload;
+   };
+
+   AddressIndex(std::vector<Range<Region> > &regions,
+                std::vector<Range<Module> > &modules,
+                std::vector<Range<FunctionBase> > &functions,
+                std::vector<Range<Symbol> > &symbols);
+
+   void lookup(Offset addr, AddressInfo &info) const;
+   void lookupSorted(const std::vector<Offset> &addrs,
+                     std::vector<AddressInfo> &infos) const;
+
+   size_t numSegments() const { return starts.size(); }
+
+ private:
+   //Segment i covers [starts[i], starts[i+1]), values[i] describes it
+   std::vector<Offset> starts;
+   std::vector<AddressInfo> values;
+
+   //Segment starts in Eytzinger order, 1-based, with their sorted index
+   std::vector<Offset> eytzinger;
+   std::vector<unsigned> eytzinger_rank;
+
+   void buildEytzinger(unsigned &sorted_pos, unsigned node);
+   int findSegment(Offset addr) const;
+};
+
+}
+}
+
+#endif
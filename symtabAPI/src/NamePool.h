@@ -0,0 +1,65 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#if !defined(_Name_Pool_h_)
+#define _Name_Pool_h_
+
+#include <stddef.h>
+#include <string>
+
+namespace Dyninst {
+namespace SymtabAPI {
+
+/**
+ * A process-wide pool of interned, NUL-terminated names.
+ *
+ * Each distinct name is stored once, so equal names get equal pointers.
+ * Names are reference counted: intern and addRef take a reference,
+ * release drops one, and a name is freed with its last reference.  The
+ * empty string is not counted.  All operations are thread-safe; the pool
+ * is split into shards to keep parallel symbol parsing from contending on
+ * one lock.
+ **/
+class NamePool
+{
+ public:
+   static const char *intern(const char *s, size_t len);
+   static const char *intern(const std::string &s) { return intern(s.c_str(), s.size()); }
+   static void addRef(const char *s);
+   static void release(const char *s);
+
+   //Bytes of name storage currently held
+   static size_t bytes();
+};
+
+}
+}
+
+#endif
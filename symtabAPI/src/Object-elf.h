@@ -59,6 +59,7 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <set>
+#include <functional>
 #include <sys/types.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
@@ -548,6 +549,9 @@ private:
   // existing symbols
   bool parse_all_relocations(Elf_X &, Elf_X_Shdr *, Elf_X_Shdr *,
           Elf_X_Shdr *, Elf_X_Shdr *);
+
+  void adviseSections();
+  void releaseParsedSections();
   
   void parseDynamic(Elf_X_Shdr *& dyn_scnp, Elf_X_Shdr *&dynsym_scnp, 
                     Elf_X_Shdr *&dynstr_scnp);
@@ -557,7 +561,8 @@ private:
                      Elf_X_Shdr* symscnp,
                      Elf_X_Shdr* symtab_shndx_scnp,
                      bool shared_library,
-                     std::string module);
+                     std::string module,
+                     const std::function<void()> &alongside = std::function<void()>());
   
   void parse_dynamicSymbols( Elf_X_Shdr *& dyn_scnp, Elf_X_Data &symdata,
                              Elf_X_Data &strdata, bool shared_library,
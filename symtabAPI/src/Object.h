@@ -135,6 +135,10 @@ public:
     SYMTAB_EXPORT bool hasError() const;
     SYMTAB_EXPORT virtual bool isBigEndianDataEncoding() const { return false; }
     SYMTAB_EXPORT virtual bool getABIVersion(int & /*major*/, int & /*minor*/) const { return false; }
+    // Time and page faults spent in each phase of loading the object, in
+    // the order the phases completed
+    SYMTAB_EXPORT const std::vector<LoadPhaseStats> &getLoadPhaseStats() const
+    { return load_phase_stats_; }
 
 
     virtual void setTruncateLinePaths(bool value);
@@ -200,6 +204,7 @@ friend class Module;
     int addressWidth_nbytes;
 
     std::vector<ExceptionBlock> catch_addrs_; //Addresses of C++ try/catch blocks;
+    std::vector<LoadPhaseStats> load_phase_stats_;
     Symtab* associated_symtab;
 
 private:
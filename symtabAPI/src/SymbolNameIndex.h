@@ -0,0 +1,88 @@
+/*
+ * See the dyninst/COPYRIGHT file for copyright information.
+ * 
+ * We provide the Paradyn Tools (below described as "Paradyn")
+ * on an AS IS basis, and do not warrant its validity or performance.
+ * We reserve the right to update, modify, or discontinue this
+ * software at any time.  We shall have no obligation to supply such
+ * updates or modifications or any other form of support to you.
+ * 
+ * By your use of Paradyn, you understand and agree that we (or any
+ * other person or entity with proprietary rights in Paradyn) are
+ * under no obligation to provide either maintenance services,
+ * update services, notices of latent defects, or correction of
+ * defects for Paradyn.
+ * 
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#if !defined(_Symbol_Name_Index_h_)
+#define _Symbol_Name_Index_h_
+
+#include "Symtab.h"
+#include <string>
+#include <vector>
+
+namespace Dyninst {
+namespace SymtabAPI {
+
+/**
+ * An immutable trigram index over the mangled, pretty and typed names
+ * of a Symtab's defined symbols, for wildcard ('*' and '?') searches.
+ *
+ * Each distinct name is stored once.  A pattern's literal runs are cut
+ * into case-folded trigrams whose posting lists are intersected, and
+ * only the surviving names are checked with the full pattern.  Names
+ * are demangled once, when the index is built.
+ **/
+class SymbolNameIndex
+{
+ public:
+   SymbolNameIndex(const std::vector<Symbol *> &syms);
+
+   //Appends every symbol with a name of a kind in nameType that matches
+   // pattern.  A symbol may be appended more than once.
+   void find(const std::string &pattern, NameType nameType, bool checkCase,
+             std::vector<Symbol *> &ret) const;
+
+   size_t numNames() const;
+
+ private:
+   struct Names {
+      //Name i is at pool[name[i]]; its symbols are syms[first[i], first[i+1])
+      std::string pool;
+      std::vector<uint32_t> name;
+      std::vector<uint32_t> first;
+      std::vector<Symbol *> syms;
+
+      //Names containing grams[i] are gram_names[gram_first[i], gram_first[i+1])
+      std::vector<uint32_t> grams;
+      std::vector<uint32_t> gram_first;
+      std::vector<uint32_t> gram_names;
+
+      void build(std::vector<std::pair<std::string, Symbol *> > &entries);
+      void find(const std::string &pattern, const std::vector<uint32_t> &qgrams,
+                bool checkCase, std::vector<Symbol *> &ret) const;
+   };
+
+   Names mangled;
+   Names pretty;
+   Names typed;
+};
+
+}
+}
+
+#endif